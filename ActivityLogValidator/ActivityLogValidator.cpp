@@ -6,7 +6,7 @@
 //Author: Connor Gilmore
 //Date: 10/19/2024
 //Class: CS 4500 - Intro To Software Profession
-//Desc: This program automatically checks all Log CSV files in the folder. 
+//Desc: This program automatically checks all Log CSV files in the folder, and inside any zip/tar/tar.gz archives in the folder. 
 // Checks to make sure csv file format is correct,header details are correct, and log details are correct.
 //Sources
 //Code Reused And Adapted From Phase 1 Program B and C
@@ -28,6 +28,10 @@
 #include <filesystem>
 #include <iomanip>
 #include <ctime>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string_view>
 
 using namespace std;
 using namespace std::filesystem;
@@ -92,6 +96,412 @@ struct LogDetails {
 		}
 	}
 };
+//limits data structure to cap how much of a csv row is held in memory at once.
+//rows longer than MaxLineLength, or with a cell longer than MaxCellLength, are reported and skipped
+struct RowLimits {
+	size_t MaxLineLength;
+	size_t MaxCellLength;
+};
+//data structure to keep a running CRC-32 checksum, which zip and gzip record for every file to detect damaged data
+struct Crc32Checksum {
+	unsigned int Value = 0;
+	//Action: add bytes to the checksum
+	//Parameter: pointer to the first byte, amount of bytes
+	void Update(const char* bytes, size_t count)
+	{
+		static const vector<unsigned int> table = BuildTable();
+		unsigned int crc = ~Value;
+		for (size_t i = 0; i < count; i++)
+		{
+			crc = table[(crc ^ static_cast<unsigned char>(bytes[i])) & 0xFF] ^ (crc >> 8);
+		}
+		Value = ~crc;
+	}
+	//Action: build the lookup table for the standard CRC-32 polynomial
+	//Return: checksum of every possible byte value
+	static vector<unsigned int> BuildTable()
+	{
+		const unsigned int POLYNOMIAL = 0xEDB88320;
+		vector<unsigned int> table(256);
+		for (unsigned int byte = 0; byte < 256; byte++)
+		{
+			unsigned int crc = byte;
+			for (int bit = 0; bit < 8; bit++)
+			{
+				crc = (crc & 1) ? (crc >> 1) ^ POLYNOMIAL : crc >> 1;
+			}
+			table[byte] = crc;
+		}
+		return table;
+	}
+};
+//stream buffer data structure that lets a reader see only the next 'byteLimit' bytes of another stream.
+//used to read a single entry out of an archive without extracting it to disk
+class LimitedBuffer : public streambuf {
+public:
+	//Action: constructor to wrap the source stream
+	//Parameter: source stream positioned at the start of the entry, amount of bytes in the entry
+	LimitedBuffer(istream& source, unsigned long long byteLimit)
+		: source(source), remaining(byteLimit), buffer(BUFFER_SIZE)
+	{
+	}
+	//Action: get the checksum of every byte read from the entry so far
+	//Return: running CRC-32 checksum
+	const Crc32Checksum& Checksum() const
+	{
+		return checksum;
+	}
+protected:
+	//Action: refill the buffer with the next chunk of the entry.
+	// throw error if the source stream ends before the entry does
+	//Return: next character or end of file
+	int_type underflow() override
+	{
+		if (gptr() < egptr())
+		{
+			return traits_type::to_int_type(*gptr());
+		}
+		if (remaining == 0)
+		{
+			return traits_type::eof();
+		}
+		streamsize chunkSize = static_cast<streamsize>(min<unsigned long long>(remaining, BUFFER_SIZE));
+		source.read(buffer.data(), chunkSize);
+		streamsize bytesRead = source.gcount();
+		if (bytesRead == 0)
+		{
+			throw runtime_error("Archive Entry Is Truncated.");
+		}
+		remaining -= bytesRead;
+		checksum.Update(buffer.data(), bytesRead);
+		setg(buffer.data(), buffer.data(), buffer.data() + bytesRead);
+		return traits_type::to_int_type(*gptr());
+	}
+private:
+	static const int BUFFER_SIZE = 16384;
+	istream& source;
+	unsigned long long remaining;
+	vector<char> buffer;
+	Crc32Checksum checksum;
+};
+//data structure to represent a canonical huffman code used by deflate compression
+struct HuffmanCode {
+	static const int MAX_BITS = 15;
+	vector<short> counts;
+	vector<short> symbols;
+	//Action: constructor to build the code from the bit length of every symbol
+	// throw error if the lengths do not describe a valid code
+	//Parameter: bit lengths for each symbol
+	HuffmanCode(const vector<short>& lengths) : counts(MAX_BITS + 1, 0), symbols(lengths.size(), 0)
+	{
+		for (short length : lengths)
+		{
+			counts[length]++;
+		}
+		int codesLeft = 1;
+		for (int bits = 1; bits <= MAX_BITS; bits++)
+		{
+			codesLeft = (codesLeft << 1) - counts[bits];
+			if (codesLeft < 0)
+			{
+				throw runtime_error("Compressed Data Is Corrupt.");
+			}
+		}
+		vector<short> offsets(MAX_BITS + 1, 0);
+		for (int bits = 1; bits < MAX_BITS; bits++)
+		{
+			offsets[bits + 1] = offsets[bits] + counts[bits];
+		}
+		for (size_t symbol = 0; symbol < lengths.size(); symbol++)
+		{
+			if (lengths[symbol] != 0)
+			{
+				symbols[offsets[lengths[symbol]]++] = static_cast<short>(symbol);
+			}
+		}
+	}
+};
+//stream buffer data structure that decompresses raw deflate data (the format used by zip and gzip) as it is read.
+//only a 32KB window of past output is kept, so an entry of any size is never held in memory all at once
+class InflateBuffer : public streambuf {
+public:
+	//Action: constructor to wrap the compressed source stream
+	//Parameter: source stream positioned at the start of the deflate data
+	InflateBuffer(istream& source)
+		: source(source), buffer(BUFFER_SIZE), window(WINDOW_SIZE)
+	{
+	}
+	//Action: get the checksum of every byte decompressed so far
+	//Return: running CRC-32 checksum
+	const Crc32Checksum& Checksum() const
+	{
+		return checksum;
+	}
+	//Action: get the amount of bytes decompressed so far
+	//Return: decompressed size
+	unsigned long long TotalOutput() const
+	{
+		return totalOutput;
+	}
+protected:
+	//Action: decompress the next chunk of data into the buffer
+	//Return: next character or end of file
+	int_type underflow() override
+	{
+		if (gptr() < egptr())
+		{
+			return traits_type::to_int_type(*gptr());
+		}
+		size_t produced = 0;
+		while (produced < buffer.size() && isFinished == false)
+		{
+			if (matchLength > 0)
+			{
+				Emit(window[(windowPosition - matchDistance) & (WINDOW_SIZE - 1)], produced);
+				matchLength--;
+			}
+			else if (blockType == NO_BLOCK)
+			{
+				StartBlock();
+			}
+			else if (blockType == STORED_BLOCK)
+			{
+				if (storedRemaining == 0)
+				{
+					blockType = NO_BLOCK;
+				}
+				else
+				{
+					Emit(static_cast<char>(ReadByte()), produced);
+					storedRemaining--;
+				}
+			}
+			else
+			{
+				DecodeSymbol(produced);
+			}
+		}
+		if (produced == 0)
+		{
+			return traits_type::eof();
+		}
+		checksum.Update(buffer.data(), produced);
+		setg(buffer.data(), buffer.data(), buffer.data() + produced);
+		return traits_type::to_int_type(*gptr());
+	}
+private:
+	static const int BUFFER_SIZE = 16384;
+	static const int WINDOW_SIZE = 32768;
+	static const int NO_BLOCK = -1;
+	static const int STORED_BLOCK = 0;
+	static const int FIXED_BLOCK = 1;
+	static const int DYNAMIC_BLOCK = 2;
+	static const int END_OF_BLOCK = 256;
+
+	istream& source;
+	vector<char> buffer;
+	vector<char> window;
+	size_t windowPosition = 0;
+	unsigned long long totalOutput = 0;
+	unsigned int bitBuffer = 0;
+	int bitCount = 0;
+	bool isFinalBlock = false;
+	bool isFinished = false;
+	int blockType = NO_BLOCK;
+	unsigned int storedRemaining = 0;
+	int matchLength = 0;
+	int matchDistance = 0;
+	vector<HuffmanCode> codes;
+	Crc32Checksum checksum;
+
+	//Action: read one byte of compressed data, throw error if the data ends early
+	//Return: byte value
+	int ReadByte()
+	{
+		int byte = source.get();
+		if (byte == char_traits<char>::eof())
+		{
+			throw runtime_error("Compressed Data Ended Unexpectedly.");
+		}
+		return byte;
+	}
+	//Action: read bits from the compressed data, least significant bit first
+	//Parameter: amount of bits to read
+	//Return: value of the bits
+	int ReadBits(int amount)
+	{
+		while (bitCount < amount)
+		{
+			bitBuffer |= static_cast<unsigned int>(ReadByte()) << bitCount;
+			bitCount += 8;
+		}
+		int value = static_cast<int>(bitBuffer & ((1u << amount) - 1));
+		bitBuffer >>= amount;
+		bitCount -= amount;
+		return value;
+	}
+	//Action: decode one symbol from the compressed data bit by bit
+	//Parameter: huffman code to decode with
+	//Return: decoded symbol
+	int Decode(const HuffmanCode& code)
+	{
+		int value = 0;
+		int first = 0;
+		int index = 0;
+		for (int bits = 1; bits <= HuffmanCode::MAX_BITS; bits++)
+		{
+			value |= ReadBits(1);
+			int count = code.counts[bits];
+			if (value - count < first)
+			{
+				return code.symbols[index + (value - first)];
+			}
+			index += count;
+			first = (first + count) << 1;
+			value <<= 1;
+		}
+		throw runtime_error("Compressed Data Is Corrupt.");
+	}
+	//Action: add a decompressed character to the buffer and to the window of past output
+	//Parameter: character, amount of characters in the buffer so far
+	void Emit(char character, size_t& produced)
+	{
+		buffer[produced++] = character;
+		window[windowPosition] = character;
+		windowPosition = (windowPosition + 1) & (WINDOW_SIZE - 1);
+		totalOutput++;
+	}
+	//Action: read the header of the next deflate block and get ready to decode it
+	void StartBlock()
+	{
+		if (isFinalBlock)
+		{
+			isFinished = true;
+			return;
+		}
+		isFinalBlock = ReadBits(1) == 1;
+		blockType = ReadBits(2);
+		codes.clear();
+		if (blockType == STORED_BLOCK)
+		{
+			bitBuffer = 0;
+			bitCount = 0;
+			unsigned int length = ReadByte() | (ReadByte() << 8);
+			unsigned int lengthComplement = ReadByte() | (ReadByte() << 8);
+			if (length != (~lengthComplement & 0xFFFF))
+			{
+				throw runtime_error("Compressed Data Is Corrupt.");
+			}
+			storedRemaining = length;
+		}
+		else if (blockType == FIXED_BLOCK)
+		{
+			vector<short> lengths(288);
+			fill(lengths.begin(), lengths.begin() + 144, 8);
+			fill(lengths.begin() + 144, lengths.begin() + 256, 9);
+			fill(lengths.begin() + 256, lengths.begin() + 280, 7);
+			fill(lengths.begin() + 280, lengths.end(), 8);
+			codes.emplace_back(lengths);
+			codes.emplace_back(vector<short>(30, 5));
+		}
+		else if (blockType == DYNAMIC_BLOCK)
+		{
+			ReadDynamicCodes();
+		}
+		else
+		{
+			throw runtime_error("Compressed Data Is Corrupt.");
+		}
+	}
+	//Action: read the literal/length and distance huffman codes stored at the start of a dynamic block
+	void ReadDynamicCodes()
+	{
+		const int ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+		int literalCount = ReadBits(5) + 257;
+		int distanceCount = ReadBits(5) + 1;
+		int lengthCodeCount = ReadBits(4) + 4;
+		vector<short> lengthCodeLengths(19, 0);
+		for (int i = 0; i < lengthCodeCount; i++)
+		{
+			lengthCodeLengths[ORDER[i]] = static_cast<short>(ReadBits(3));
+		}
+		HuffmanCode lengthCode(lengthCodeLengths);
+
+		vector<short> lengths;
+		while (static_cast<int>(lengths.size()) < literalCount + distanceCount)
+		{
+			int symbol = Decode(lengthCode);
+			if (symbol < 16)
+			{
+				lengths.push_back(static_cast<short>(symbol));
+				continue;
+			}
+			short repeatedLength = 0;
+			int repeat = 0;
+			if (symbol == 16)
+			{
+				if (lengths.empty())
+				{
+					throw runtime_error("Compressed Data Is Corrupt.");
+				}
+				repeatedLength = lengths.back();
+				repeat = 3 + ReadBits(2);
+			}
+			else if (symbol == 17)
+			{
+				repeat = 3 + ReadBits(3);
+			}
+			else
+			{
+				repeat = 11 + ReadBits(7);
+			}
+			if (static_cast<int>(lengths.size()) + repeat > literalCount + distanceCount)
+			{
+				throw runtime_error("Compressed Data Is Corrupt.");
+			}
+			lengths.insert(lengths.end(), repeat, repeatedLength);
+		}
+		codes.emplace_back(vector<short>(lengths.begin(), lengths.begin() + literalCount));
+		codes.emplace_back(vector<short>(lengths.begin() + literalCount, lengths.end()));
+	}
+	//Action: decode the next literal, end of block, or back reference in a huffman block
+	//Parameter: amount of characters in the buffer so far
+	void DecodeSymbol(size_t& produced)
+	{
+		const short LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+		const short LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+		const short DISTANCE_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+		const short DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+		int symbol = Decode(codes[0]);
+		if (symbol < END_OF_BLOCK)
+		{
+			Emit(static_cast<char>(symbol), produced);
+			return;
+		}
+		if (symbol == END_OF_BLOCK)
+		{
+			blockType = NO_BLOCK;
+			return;
+		}
+		symbol -= END_OF_BLOCK + 1;
+		if (symbol >= 29)
+		{
+			throw runtime_error("Compressed Data Is Corrupt.");
+		}
+		matchLength = LENGTH_BASE[symbol] + ReadBits(LENGTH_EXTRA[symbol]);
+		symbol = Decode(codes[1]);
+		if (symbol >= 30)
+		{
+			throw runtime_error("Compressed Data Is Corrupt.");
+		}
+		matchDistance = DISTANCE_BASE[symbol] + ReadBits(DISTANCE_EXTRA[symbol]);
+		if (static_cast<unsigned long long>(matchDistance) > totalOutput)
+		{
+			throw runtime_error("Compressed Data Is Corrupt.");
+		}
+	}
+};
 
 //Action: Prints Intro Screen
 void WriteAppIntro();
@@ -109,6 +519,51 @@ vector<string> FetchAllCsvFileNamesInFolder();
 //Parameter: fileNames (vector<string>), list of all csv file names in the folder
 //Return: a vector list of all the csv files that match the format 'LastnameFirstnameLog.csv'
 vector<string> FilterFilesForActivityLogFormat(vector<string> fileNames);
+//Action: checks if a file name matches the 'LastnameFirstnameLog.csv' format
+//Parameter: fileName (string), file name without any folder path
+//Return: true if file name matches the format
+bool IsActivityLogFileName(string fileName);
+//Action: get all the zip, tar, and tar.gz archives in the folder
+//Return: a vector list of all the archive file names in the folder
+vector<string> FetchAllLogArchiveNamesInFolder();
+//Action: validate every entry in an archive that matches the 'LastnameFirstnameLog.csv' format, without extracting the archive.
+// if the archive can not be opened or read, report it as an error and move on so other archives are still checked
+//Parameter: archiveName (string), name of the zip, tar, or tar.gz archive
+//Return: report of problems found in the archive's log files
+string ValidateArchive(string archiveName);
+//Action: validate the log entries in a zip archive using its central directory
+//Parameter: archiveName (string), name of the zip archive
+//Return: report of problems found in the archive's log files
+string ValidateZipArchive(string archiveName);
+//Action: validate the log entries in a tar archive as they stream past
+//Parameter: tar archive stream, archiveName (string) used to name each entry in the report
+//Return: report of problems found in the archive's log files
+string ValidateTarArchive(istream& archive, string archiveName);
+//Action: find the 'path' record in a pax extended header. each record looks like '<length> <key>=<value>' and ends in a newline
+//Parameter: paxHeader (string), contents of the pax header entry
+//Return: path of the next entry, or empty if the header has no path record
+string ReadPaxPath(string paxHeader);
+//Action: skip the gzip header and validate the compressed tar archive inside it
+//Parameter: archiveName (string), name of the tar.gz archive
+//Return: report of problems found in the archive's log files
+string ValidateTarGzArchive(string archiveName);
+//Action: validate a single log file entry read from an archive
+//Parameter: entryPath (string) archive name and path of the entry, entry stream
+//Return: report section for the entry
+string ValidateArchiveEntry(string entryPath, istream& entry);
+//Action: read whatever the validator left of an archive entry, then compare the entry's CRC-32 with the one the archive recorded.
+// nothing is checked if reading the entry already failed, since that error is in the report
+//Parameter: entry stream, checksum of the bytes read from it, CRC-32 recorded in the archive
+//Return: error message or empty
+string CheckArchiveEntryCrc(istream& entry, const Crc32Checksum& checksum, unsigned int expectedCrc);
+//Action: build the report section for a problem with a whole archive
+//Parameter: archiveName (string), error (string) describing the problem
+//Return: report section for the archive
+string ReportArchiveError(string archiveName, string error);
+//Action: convert little endian bytes from an archive header to a number
+//Parameter: pointer to the first byte, amount of bytes
+//Return: number
+unsigned long long ReadLittleEndian(const char* bytes, int byteCount);
 //Action: return error message if log file is empty.
 // parse through all the cells in the cell csv file until an error is found, or all cells have been checked.
 // if error is found stop parsing and report error.
@@ -116,6 +571,20 @@ vector<string> FilterFilesForActivityLogFormat(vector<string> fileNames);
 //Parameter:vector string representing csv log file name for access
 //Return: error message or empty
 string ValidateFile(string fileName);
+//Action: return error message if log stream is empty.
+// parse through all the cells in the csv stream until an error is found, or all cells have been checked.
+// rows or cells longer than the limits are reported and skipped, and the rest of the stream keeps being checked.
+//Parameter: stream of csv log data, from a file or an archive entry. limits on row and cell length
+//Return: error message or empty
+string ValidateStream(istream& file, RowLimits limits);
+//Action: read the next row into a fixed size buffer. if the row does not fit, skip the rest of it
+//Parameter: csv stream, buffer sized for the longest allowed row plus one, length of the row read (the row may contain NUL characters), bool set to true if row was skipped
+//Return: false when there are no more rows
+bool ReadBoundedRow(istream& file, vector<char>& rowBuffer, size_t& rowLength, bool& isOversized);
+//Action: split a row into its non empty cells. stop and return false if any cell is too long
+//Parameter: row text, vector to fill with cells, longest allowed cell
+//Return: true if every cell fit within the limit
+bool SplitRowIntoCells(string_view row, vector<string>& cells, size_t maxCellLength);
 //Action: error message if cells vector has more or less than two elements.
 // error message if first name cell is not Alphabetical
 // // error message if second name cell is not Alphabetical
@@ -185,6 +654,9 @@ void WriteAppOutro();
 
 string extraContent = "";
 
+//longest row and cell a log file may contain. notes are capped at 80 characters by ValidateNote, so these leave plenty of room
+const RowLimits DEFAULT_ROW_LIMITS = { 1024, 256 };
+
 //Program A starts here
 int main()
 {
@@ -193,7 +665,9 @@ int main()
 	
 	WriteAppIntro();
 
-	vector<string> activityLogs = FindActivityLogFiles();
+	vector<string> logArchives = FetchAllLogArchiveNamesInFolder();
+
+	vector<string> activityLogs = (logArchives.empty()) ? FindActivityLogFiles() : FilterFilesForActivityLogFormat(FetchAllCsvFileNamesInFolder());
 
 	for (string& activityLog : activityLogs) {
 		validityReport += "\n\n\n\nNow Validating Log File '" + activityLog + "':\n\n";
@@ -202,6 +676,10 @@ int main()
 		extraContent = "";
 	}
 
+	for (string& logArchive : logArchives) {
+		validityReport += ValidateArchive(logArchive);
+	}
+
 	GenerateFileReport(validityReport);
 	GenerateConsoleReport(validityReport);
 
@@ -247,36 +725,70 @@ void GenerateConsoleReport(string report)
 //Return: error message or empty
 string ValidateFile(string fileName)
 {
-	string fileReport = "";
 	ifstream file(fileName);
 
 	if (file.is_open() == false) {
 		throw runtime_error("File Error: Could not open the CSV file.");
 	}
+
+	string fileReport = ValidateStream(file, DEFAULT_ROW_LIMITS);
+
+	file.close();
+
+	return fileReport;
+}
+//Action: return error message if log stream is empty.
+// parse through all the cells in the csv stream until an error is found, or all cells have been checked.
+// rows or cells longer than the limits are reported and skipped, and the rest of the stream keeps being checked.
+//Parameter: stream of csv log data, from a file or an archive entry. limits on row and cell length
+//Return: error message or empty
+string ValidateStream(istream& file, RowLimits limits)
+{
+	string fileReport = "";
+	string skippedReport = "";
 	const int FIRST_ROW = 0;
 	const int SECOND_ROW = 1;
 	const int REQUIRED_AMOUNT_OF_ROWS = 1;
+	const int MAX_SKIPPED_ROWS_REPORTED = 10;
 
-	string row;
+	vector<char> rowBuffer(limits.MaxLineLength + 1);
+	size_t rowLength = 0;
+	bool isOversized = false;
 
 	int rowCounter = 0;
+	int skippedRows = 0;
 
-	while (getline(file, row)) {
+	while (ReadBoundedRow(file, rowBuffer, rowLength, isOversized)) {
 		vector<string> cells;
-		stringstream streamForRow(row);
-		string cell;
 
 		if (fileReport != "")
 		{
 			break;
 		}
 
-		while (getline(streamForRow, cell, ',')) {
-			if (cell != "")
+		string skippedReason = "";
+		if (isOversized)
+		{
+			skippedReason = "Row Is Longer Than " + to_string(limits.MaxLineLength) + " Characters";
+		}
+		else if (SplitRowIntoCells(string_view(rowBuffer.data(), rowLength), cells, limits.MaxCellLength) == false)
+		{
+			skippedReason = "A Cell Is Longer Than " + to_string(limits.MaxCellLength) + " Characters";
+		}
+
+		if (skippedReason != "")
+		{
+			if (skippedRows < MAX_SKIPPED_ROWS_REPORTED)
 			{
-				cells.push_back(cell);
-				cout << cell + "\n" << endl;
+				skippedReport += "Line " + to_string(rowCounter + 1) + " Error: " + skippedReason + ". Row Was Skipped.\n";
 			}
+			skippedRows++;
+			rowCounter++;
+			continue;
+		}
+
+		for (const string& cell : cells) {
+			cout << cell + "\n" << endl;
 		}
 		cout << to_string(cells.size()) + "\n" << endl;
 
@@ -301,10 +813,70 @@ string ValidateFile(string fileName)
 		fileReport = "Log File Error: File Is Empty!\n";
 	}
 
-	file.close();
+	if (skippedRows > MAX_SKIPPED_ROWS_REPORTED)
+	{
+		skippedReport += "Log File Error: " + to_string(skippedRows - MAX_SKIPPED_ROWS_REPORTED) + " More Oversized Row(s) Were Skipped.\n";
+	}
 
-	return fileReport;
+	return skippedReport + fileReport;
+
+}
+//Action: read the next row into a fixed size buffer. if the row does not fit, skip the rest of it
+//Parameter: csv stream, buffer sized for the longest allowed row plus one, length of the row read (the row may contain NUL characters), bool set to true if row was skipped
+//Return: false when there are no more rows
+bool ReadBoundedRow(istream& file, vector<char>& rowBuffer, size_t& rowLength, bool& isOversized)
+{
+	isOversized = false;
+	rowLength = 0;
+
+	file.getline(rowBuffer.data(), rowBuffer.size());
+
+	if (file.fail() == false)
+	{
+		//gcount includes the newline, unless the row was ended by the end of the file instead
+		rowLength = static_cast<size_t>(file.gcount()) - (file.eof() ? 0 : 1);
+		return true;
+	}
+	if (file.bad() || file.gcount() == 0)
+	{
+		return false;
+	}
+
+	//buffer filled before the end of the row was found, so throw away the rest of the row without storing it
+	isOversized = true;
+	file.clear();
+	file.ignore(numeric_limits<streamsize>::max(), '\n');
+
+	return true;
+}
+//Action: split a row into its non empty cells. stop and return false if any cell is too long
+//Parameter: row text, vector to fill with cells, longest allowed cell
+//Return: true if every cell fit within the limit
+bool SplitRowIntoCells(string_view row, vector<string>& cells, size_t maxCellLength)
+{
+	size_t cellStart = 0;
+
+	while (cellStart <= row.size()) {
+		size_t cellEnd = row.find(',', cellStart);
+		if (cellEnd == string_view::npos)
+		{
+			cellEnd = row.size();
+		}
+
+		size_t cellLength = cellEnd - cellStart;
+		if (cellLength > maxCellLength)
+		{
+			return false;
+		}
+		if (cellLength > 0)
+		{
+			cells.emplace_back(row.substr(cellStart, cellLength));
+		}
+
+		cellStart = cellEnd + 1;
+	}
 
+	return true;
 }
 
 //Action: return error message if log row is less than 5 cells or more than 6 cells. That would be invalid format
@@ -607,7 +1179,7 @@ void WriteAppIntro()
 	cout << "\nProgram A: Validity Checks on Multiple Log Files\n" << endl;
 	cout << "\nAuthor: Connor Gilmore\n" << endl;
 	cout << "\nGroup: Team 1\n" << endl;
-	cout << "\nAbout: Verify format and content of Activity log files in the current folder.\n" << endl;
+	cout << "\nAbout: Verify format and content of Activity log files in the current folder, including log files inside .zip, .tar, and .tar.gz archives.\n" << endl;
 	cout << "\n\Summary: Press Enter and program automatically checks all Log CSV files in the folder. Checks to make sure csv file format is correct,header details are correct, and log details are correct." << endl;
 	cout << "Header Issues: extra or too few cells, class is not called 'CS 4500' or missing, first and last name are not names" << endl;
 	cout << "Log Issues:extra or too few cells, incorrect date and time format, start/end times span more than 4 hours(warning), start/end times span more than 24 hours, group size is not an whole number between 1 - 50 inclusivly, unknown activity code, empty note when activity code is 'Other', note is more than 80 characters, note has commas.\n" << endl;
@@ -669,21 +1241,593 @@ vector<string> FilterFilesForActivityLogFormat(vector<string> fileNames)
 {
 	vector<string> results;
 
-	for (string& fileName : fileNames) {
-		fileName = fileName.substr(0, fileName.size() - 4);//this is just removing the .csv ext
+	for (const string& fileName : fileNames) {
+		if (IsActivityLogFileName(fileName))
+		{
+			results.push_back(fileName);
+		}
 	}
 
-	regex csvFileActivityLogPattern(R"(^[a-zA-Z]+Log$)");
+	return results;
+}
+//Action: checks if a file name matches the 'LastnameFirstnameLog.csv' format
+//Parameter: fileName (string), file name without any folder path
+//Return: true if file name matches the format
+bool IsActivityLogFileName(string fileName)
+{
+	static const regex csvFileActivityLogPattern(R"(^[a-zA-Z]+Log\.csv$)");
 
-	for (const string& fileName : fileNames) {
-		if (regex_match(fileName, csvFileActivityLogPattern))
-		{
-			results.push_back(fileName + ".csv");
+	return regex_match(fileName, csvFileActivityLogPattern);
+}
+//Action: get all the zip, tar, and tar.gz archives in the folder
+//Return: a vector list of all the archive file names in the folder
+vector<string> FetchAllLogArchiveNamesInFolder()
+{
+	vector<string> results;
+
+	path pathOfCurrentFolder = current_path();
+
+	for (const auto& file : directory_iterator(pathOfCurrentFolder)) {
+		string fileName = file.path().filename().string();
+
+		if (fileName.ends_with(".zip") || fileName.ends_with(".tar") || fileName.ends_with(".tar.gz") || fileName.ends_with(".tgz")) {
+			results.push_back(fileName);
 		}
 	}
 
 	return results;
 }
+//Action: validate every entry in an archive that matches the 'LastnameFirstnameLog.csv' format, without extracting the archive.
+// if the archive can not be opened or read, report it as an error and move on so other archives are still checked
+//Parameter: archiveName (string), name of the zip, tar, or tar.gz archive
+//Return: report of problems found in the archive's log files
+string ValidateArchive(string archiveName)
+{
+	string archiveReport = "";
+
+	try {
+		if (archiveName.ends_with(".zip"))
+		{
+			archiveReport = ValidateZipArchive(archiveName);
+		}
+		else if (archiveName.ends_with(".tar.gz") || archiveName.ends_with(".tgz"))
+		{
+			archiveReport = ValidateTarGzArchive(archiveName);
+		}
+		else
+		{
+			ifstream archive(archiveName, ios::binary);
+			if (archive.is_open() == false) {
+				throw runtime_error("Could Not Open The Archive.");
+			}
+			archiveReport = ValidateTarArchive(archive, archiveName);
+		}
+	}
+	catch (const runtime_error& e) {
+		return ReportArchiveError(archiveName, e.what());
+	}
+
+	if (archiveReport == "")
+	{
+		archiveReport = ReportArchiveError(archiveName, "No Files Match The Format 'XLog.csv' In The Archive.");
+	}
+
+	return archiveReport;
+}
+//Action: validate the log entries in a zip archive using its central directory
+//Parameter: archiveName (string), name of the zip archive
+//Return: report of problems found in the archive's log files
+string ValidateZipArchive(string archiveName)
+{
+	const unsigned long long END_RECORD_SIGNATURE = 0x06054b50;
+	const unsigned long long ZIP64_LOCATOR_SIGNATURE = 0x07064b50;
+	const unsigned long long ZIP64_END_RECORD_SIGNATURE = 0x06064b50;
+	const unsigned long long ENTRY_RECORD_SIGNATURE = 0x02014b50;
+	const unsigned long long LOCAL_RECORD_SIGNATURE = 0x04034b50;
+	const int END_RECORD_SIZE = 22;
+	const int ZIP64_LOCATOR_SIZE = 20;
+	const int ZIP64_END_RECORD_SIZE = 56;
+	const int ENTRY_RECORD_SIZE = 46;
+	const int LOCAL_RECORD_SIZE = 30;
+	const int MAX_COMMENT_SIZE = 65535;
+	const int STORED = 0;
+	const int DEFLATED = 8;
+	const int ENCRYPTED_FLAG = 1;
+	const unsigned long long ZIP64_MARKER = 0xFFFFFFFF;
+	const unsigned long long ZIP64_COUNT_MARKER = 0xFFFF;
+	const unsigned long long ZIP64_EXTRA_ID = 0x0001;
+
+	ifstream archive(archiveName, ios::binary);
+	if (archive.is_open() == false) {
+		throw runtime_error("Could Not Open The Archive.");
+	}
+
+	archive.seekg(0, ios::end);
+	long long archiveSize = archive.tellg();
+	long long tailSize = min<long long>(archiveSize, END_RECORD_SIZE + MAX_COMMENT_SIZE);
+	vector<char> tail(tailSize);
+	archive.seekg(archiveSize - tailSize);
+	archive.read(tail.data(), tailSize);
+
+	long long endRecord = tailSize - END_RECORD_SIZE;
+	while (endRecord >= 0 && ReadLittleEndian(&tail[endRecord], 4) != END_RECORD_SIGNATURE)
+	{
+		endRecord--;
+	}
+	if (endRecord < 0)
+	{
+		throw runtime_error("Not A Valid Zip Archive.");
+	}
+
+	unsigned long long entryCount = ReadLittleEndian(&tail[endRecord + 10], 2);
+	unsigned long long directorySize = ReadLittleEndian(&tail[endRecord + 12], 4);
+	unsigned long long directoryOffset = ReadLittleEndian(&tail[endRecord + 16], 4);
+
+	//archives with more than 65535 entries or over 4GB keep the real values in a zip64 end record
+	if (entryCount == ZIP64_COUNT_MARKER || directorySize == ZIP64_MARKER || directoryOffset == ZIP64_MARKER)
+	{
+		long long locator = endRecord - ZIP64_LOCATOR_SIZE;
+		if (locator < 0 || ReadLittleEndian(&tail[locator], 4) != ZIP64_LOCATOR_SIGNATURE)
+		{
+			throw runtime_error("Zip64 End Record Is Missing.");
+		}
+		char zip64EndRecord[ZIP64_END_RECORD_SIZE];
+		archive.clear();
+		archive.seekg(ReadLittleEndian(&tail[locator + 8], 8));
+		archive.read(zip64EndRecord, ZIP64_END_RECORD_SIZE);
+		if (archive.gcount() != ZIP64_END_RECORD_SIZE || ReadLittleEndian(zip64EndRecord, 4) != ZIP64_END_RECORD_SIGNATURE)
+		{
+			throw runtime_error("Zip64 End Record Is Corrupt.");
+		}
+		entryCount = ReadLittleEndian(&zip64EndRecord[32], 8);
+		directorySize = ReadLittleEndian(&zip64EndRecord[40], 8);
+		directoryOffset = ReadLittleEndian(&zip64EndRecord[48], 8);
+	}
+
+	if (directoryOffset > static_cast<unsigned long long>(archiveSize) || directorySize > archiveSize - directoryOffset)
+	{
+		throw runtime_error("Not A Valid Zip Archive.");
+	}
+
+	//the directory is read one record at a time, so a huge or hostile directory never has to fit in memory.
+	//name, extra field, and comment are each capped at 65535 bytes by their 2 byte lengths
+	unsigned long long directoryPosition = directoryOffset;
+	unsigned long long directoryEnd = directoryOffset + directorySize;
+	bool isDirectoryStreamMoved = true;
+	char entryRecord[ENTRY_RECORD_SIZE];
+	string entryName;
+	vector<char> extraField;
+
+	string archiveReport = "";
+
+	for (unsigned long long entryIndex = 0; entryIndex < entryCount; entryIndex++)
+	{
+		if (isDirectoryStreamMoved)
+		{
+			archive.clear();
+			archive.seekg(directoryPosition);
+			isDirectoryStreamMoved = false;
+		}
+
+		archive.read(entryRecord, ENTRY_RECORD_SIZE);
+		if (directoryPosition + ENTRY_RECORD_SIZE > directoryEnd || archive.gcount() != ENTRY_RECORD_SIZE || ReadLittleEndian(entryRecord, 4) != ENTRY_RECORD_SIGNATURE)
+		{
+			archiveReport += ReportArchiveError(archiveName, "Zip Directory Is Corrupt. Remaining Entries Were Not Checked.");
+			break;
+		}
+		int flags = static_cast<int>(ReadLittleEndian(&entryRecord[8], 2));
+		int method = static_cast<int>(ReadLittleEndian(&entryRecord[10], 2));
+		unsigned int expectedCrc = static_cast<unsigned int>(ReadLittleEndian(&entryRecord[16], 4));
+		unsigned long long compressedSize = ReadLittleEndian(&entryRecord[20], 4);
+		unsigned long long uncompressedSize = ReadLittleEndian(&entryRecord[24], 4);
+		size_t nameLength = ReadLittleEndian(&entryRecord[28], 2);
+		size_t extraLength = ReadLittleEndian(&entryRecord[30], 2);
+		size_t commentLength = ReadLittleEndian(&entryRecord[32], 2);
+		unsigned long long localOffset = ReadLittleEndian(&entryRecord[42], 4);
+
+		directoryPosition += ENTRY_RECORD_SIZE + nameLength + extraLength + commentLength;
+		entryName.resize(nameLength);
+		extraField.resize(extraLength);
+		archive.read(entryName.data(), nameLength);
+		archive.read(extraField.data(), extraLength);
+		archive.ignore(commentLength);
+		if (directoryPosition > directoryEnd || archive.fail())
+		{
+			archiveReport += ReportArchiveError(archiveName, "Zip Directory Is Corrupt. Remaining Entries Were Not Checked.");
+			break;
+		}
+
+		//sizes and offsets too big for 4 bytes are stored, in this order, in the zip64 extra field
+		size_t extraPosition = 0;
+		while (extraPosition + 4 <= extraLength)
+		{
+			unsigned long long extraId = ReadLittleEndian(&extraField[extraPosition], 2);
+			size_t fieldEnd = extraPosition + 4 + ReadLittleEndian(&extraField[extraPosition + 2], 2);
+			if (extraId == ZIP64_EXTRA_ID && fieldEnd <= extraLength)
+			{
+				size_t fieldPosition = extraPosition + 4;
+				for (unsigned long long* value : { &uncompressedSize, &compressedSize, &localOffset })
+				{
+					if (*value == ZIP64_MARKER && fieldPosition + 8 <= fieldEnd)
+					{
+						*value = ReadLittleEndian(&extraField[fieldPosition], 8);
+						fieldPosition += 8;
+					}
+				}
+			}
+			extraPosition = fieldEnd;
+		}
+
+		if (IsActivityLogFileName(path(entryName).filename().string()) == false)
+		{
+			continue;
+		}
+
+		string entryPath = archiveName + "/" + entryName;
+		if ((flags & ENCRYPTED_FLAG) != 0 || (method != STORED && method != DEFLATED))
+		{
+			archiveReport += "\n\n\n\nNow Validating Log File '" + entryPath + "':\n\nLog File Error: File Is Encrypted Or Uses An Unsupported Compression Method.\n";
+			continue;
+		}
+
+		char localRecord[LOCAL_RECORD_SIZE];
+		isDirectoryStreamMoved = true;
+		archive.clear();
+		archive.seekg(localOffset);
+		archive.read(localRecord, LOCAL_RECORD_SIZE);
+		if (archive.gcount() != LOCAL_RECORD_SIZE || ReadLittleEndian(localRecord, 4) != LOCAL_RECORD_SIGNATURE)
+		{
+			archiveReport += "\n\n\n\nNow Validating Log File '" + entryPath + "':\n\nLog Archive Error: Zip Entry Is Corrupt.\n";
+			continue;
+		}
+		archive.seekg(ReadLittleEndian(&localRecord[26], 2) + ReadLittleEndian(&localRecord[28], 2), ios::cur);
+
+		LimitedBuffer compressedBuffer(archive, compressedSize);
+		istream compressedEntry(&compressedBuffer);
+		compressedEntry.exceptions(ios::badbit);
+
+		if (method == STORED)
+		{
+			archiveReport += ValidateArchiveEntry(entryPath, compressedEntry);
+			archiveReport += CheckArchiveEntryCrc(compressedEntry, compressedBuffer.Checksum(), expectedCrc);
+		}
+		else
+		{
+			InflateBuffer inflatedBuffer(compressedEntry);
+			istream inflatedEntry(&inflatedBuffer);
+			inflatedEntry.exceptions(ios::badbit);
+			archiveReport += ValidateArchiveEntry(entryPath, inflatedEntry);
+			archiveReport += CheckArchiveEntryCrc(inflatedEntry, inflatedBuffer.Checksum(), expectedCrc);
+		}
+	}
+
+	return archiveReport;
+}
+//Action: validate the log entries in a tar archive as they stream past
+//Parameter: tar archive stream, archiveName (string) used to name each entry in the report
+//Return: report of problems found in the archive's log files
+string ValidateTarArchive(istream& archive, string archiveName)
+{
+	const int BLOCK_SIZE = 512;
+	const int NAME_SIZE = 100;
+	const int SIZE_OFFSET = 124;
+	const int SIZE_LENGTH = 12;
+	const int CHECKSUM_OFFSET = 148;
+	const int CHECKSUM_LENGTH = 8;
+	const int TYPE_OFFSET = 156;
+	const int MAGIC_OFFSET = 257;
+	const int PREFIX_OFFSET = 345;
+	const int PREFIX_SIZE = 155;
+	const char REGULAR_FILE = '0';
+	const char OLD_REGULAR_FILE = '\0';
+	const char LONG_NAME = 'L';
+	const char PAX_HEADER = 'x';
+	const unsigned long long MAX_LONG_NAME_SIZE = 4096;
+	const unsigned long long MAX_PAX_HEADER_SIZE = 65536;
+
+	string archiveReport = "";
+	string longName = "";
+	string lastEntryName = "";
+	char header[BLOCK_SIZE];
+
+	try {
+		while (true)
+		{
+			archive.read(header, BLOCK_SIZE);
+			if (archive.gcount() == 0)
+			{
+				break;
+			}
+			if (archive.gcount() != BLOCK_SIZE)
+			{
+				throw runtime_error("Archive Is Truncated.");
+			}
+			if (all_of(header, header + BLOCK_SIZE, [](char byte) { return byte == '\0'; }))
+			{
+				break;
+			}
+
+			//checksum is the sum of every header byte, counting the checksum field itself as spaces
+			unsigned long long storedChecksum = 0;
+			int checksumStart = CHECKSUM_OFFSET;
+			while (checksumStart < CHECKSUM_OFFSET + CHECKSUM_LENGTH && header[checksumStart] == ' ')
+			{
+				checksumStart++;
+			}
+			for (int i = checksumStart; i < CHECKSUM_OFFSET + CHECKSUM_LENGTH && header[i] >= '0' && header[i] <= '7'; i++)
+			{
+				storedChecksum = storedChecksum * 8 + (header[i] - '0');
+			}
+			unsigned long long checksum = ' ' * CHECKSUM_LENGTH;
+			for (int i = 0; i < BLOCK_SIZE; i++)
+			{
+				if (i < CHECKSUM_OFFSET || i >= CHECKSUM_OFFSET + CHECKSUM_LENGTH)
+				{
+					checksum += static_cast<unsigned char>(header[i]);
+				}
+			}
+			if (checksum != storedChecksum)
+			{
+				if (lastEntryName == "")
+				{
+					throw runtime_error("Not A Valid Tar Archive.");
+				}
+				throw runtime_error("Archive Is Damaged. Entries After '" + lastEntryName + "' Were Not Checked.");
+			}
+
+			if ((header[SIZE_OFFSET] & 0x80) != 0)
+			{
+				throw runtime_error("Archive Has An Entry That Is Too Large.");
+			}
+			unsigned long long entrySize = 0;
+			int sizeStart = SIZE_OFFSET;
+			while (sizeStart < SIZE_OFFSET + SIZE_LENGTH && header[sizeStart] == ' ')
+			{
+				sizeStart++;
+			}
+			for (int i = sizeStart; i < SIZE_OFFSET + SIZE_LENGTH && header[i] >= '0' && header[i] <= '7'; i++)
+			{
+				entrySize = entrySize * 8 + (header[i] - '0');
+			}
+			unsigned long long paddingSize = (BLOCK_SIZE - entrySize % BLOCK_SIZE) % BLOCK_SIZE;
+
+			string entryName(header, strnlen(header, NAME_SIZE));
+			//only posix 'ustar\0' headers have a path prefix. gnu 'ustar  ' headers keep timestamps there instead
+			if (memcmp(&header[MAGIC_OFFSET], "ustar", 6) == 0 && header[PREFIX_OFFSET] != '\0')
+			{
+				entryName = string(&header[PREFIX_OFFSET], strnlen(&header[PREFIX_OFFSET], PREFIX_SIZE)) + "/" + entryName;
+			}
+			if (longName != "")
+			{
+				entryName = longName;
+				longName = "";
+			}
+			lastEntryName = entryName;
+
+			char entryType = header[TYPE_OFFSET];
+			LimitedBuffer entryBuffer(archive, entrySize);
+			istream entry(&entryBuffer);
+			entry.exceptions(ios::badbit);
+
+			if (entryType == LONG_NAME && entrySize <= MAX_LONG_NAME_SIZE)
+			{
+				getline(entry, longName, '\0');
+			}
+			else if (entryType == PAX_HEADER && entrySize <= MAX_PAX_HEADER_SIZE)
+			{
+				string paxHeader(entrySize, '\0');
+				entry.read(paxHeader.data(), entrySize);
+				string paxPath = ReadPaxPath(paxHeader);
+				if (paxPath != "")
+				{
+					longName = paxPath;
+				}
+			}
+			else if ((entryType == REGULAR_FILE || entryType == OLD_REGULAR_FILE) && IsActivityLogFileName(path(entryName).filename().string()))
+			{
+				archiveReport += ValidateArchiveEntry(archiveName + "/" + entryName, entry);
+				if (entry.bad())
+				{
+					archiveReport += ReportArchiveError(archiveName, "Archive Is Damaged. Entries After '" + entryName + "' Were Not Checked.");
+					break;
+				}
+			}
+
+			entry.ignore(numeric_limits<streamsize>::max());
+			archive.ignore(paddingSize);
+		}
+	}
+	catch (const runtime_error& e) {
+		archiveReport += ReportArchiveError(archiveName, e.what());
+	}
+
+	return archiveReport;
+}
+//Action: find the 'path' record in a pax extended header. each record looks like '<length> <key>=<value>' and ends in a newline
+//Parameter: paxHeader (string), contents of the pax header entry
+//Return: path of the next entry, or empty if the header has no path record
+string ReadPaxPath(string paxHeader)
+{
+	const string PATH_KEY = "path=";
+
+	size_t recordStart = 0;
+
+	while (recordStart < paxHeader.size()) {
+		size_t lengthEnd = paxHeader.find(' ', recordStart);
+		if (lengthEnd == string::npos || lengthEnd == recordStart)
+		{
+			break;
+		}
+
+		size_t recordLength = 0;
+		for (size_t i = recordStart; i < lengthEnd; i++)
+		{
+			if (isCharacterADigit(paxHeader[i]) == false)
+			{
+				return "";
+			}
+			recordLength = recordLength * 10 + (paxHeader[i] - '0');
+		}
+
+		size_t recordEnd = recordStart + recordLength;
+		if (recordEnd > paxHeader.size() || recordEnd <= lengthEnd + 1)
+		{
+			break;
+		}
+
+		//record text is between the space and the trailing newline
+		string record = paxHeader.substr(lengthEnd + 1, recordEnd - lengthEnd - 2);
+		if (record.starts_with(PATH_KEY))
+		{
+			return record.substr(PATH_KEY.size());
+		}
+
+		recordStart = recordEnd;
+	}
+
+	return "";
+}
+//Action: skip the gzip header and validate the compressed tar archive inside it
+//Parameter: archiveName (string), name of the tar.gz archive
+//Return: report of problems found in the archive's log files
+string ValidateTarGzArchive(string archiveName)
+{
+	const int HEADER_SIZE = 10;
+	const unsigned char GZIP_ID_1 = 0x1f;
+	const unsigned char GZIP_ID_2 = 0x8b;
+	const int DEFLATED = 8;
+	const int HEADER_CRC_FLAG = 0x02;
+	const int EXTRA_FLAG = 0x04;
+	const int NAME_FLAG = 0x08;
+	const int COMMENT_FLAG = 0x10;
+
+	ifstream archive(archiveName, ios::binary);
+	if (archive.is_open() == false) {
+		throw runtime_error("Could Not Open The Archive.");
+	}
+
+	char header[HEADER_SIZE];
+	archive.read(header, HEADER_SIZE);
+	if (archive.gcount() != HEADER_SIZE || static_cast<unsigned char>(header[0]) != GZIP_ID_1 || static_cast<unsigned char>(header[1]) != GZIP_ID_2 || header[2] != DEFLATED)
+	{
+		throw runtime_error("Not A Valid Gzip Archive.");
+	}
+
+	int flags = header[3];
+	if ((flags & EXTRA_FLAG) != 0)
+	{
+		char extraLength[2];
+		archive.read(extraLength, 2);
+		archive.ignore(ReadLittleEndian(extraLength, 2));
+	}
+	if ((flags & NAME_FLAG) != 0)
+	{
+		archive.ignore(numeric_limits<streamsize>::max(), '\0');
+	}
+	if ((flags & COMMENT_FLAG) != 0)
+	{
+		archive.ignore(numeric_limits<streamsize>::max(), '\0');
+	}
+	if ((flags & HEADER_CRC_FLAG) != 0)
+	{
+		archive.ignore(2);
+	}
+
+	InflateBuffer tarBuffer(archive);
+	istream tarArchive(&tarBuffer);
+	tarArchive.exceptions(ios::badbit);
+
+	string archiveReport = ValidateTarArchive(tarArchive, archiveName);
+
+	//a read error was already reported, otherwise finish decompressing and check the gzip trailer
+	if (tarArchive.bad())
+	{
+		return archiveReport;
+	}
+	try {
+		const int TRAILER_SIZE = 8;
+		const unsigned long long ISIZE_MASK = 0xFFFFFFFF;
+
+		tarArchive.ignore(numeric_limits<streamsize>::max());
+
+		char trailer[TRAILER_SIZE];
+		archive.read(trailer, TRAILER_SIZE);
+		if (archive.gcount() != TRAILER_SIZE)
+		{
+			throw runtime_error("Gzip Trailer Is Missing.");
+		}
+		if (ReadLittleEndian(trailer, 4) != tarBuffer.Checksum().Value || ReadLittleEndian(&trailer[4], 4) != (tarBuffer.TotalOutput() & ISIZE_MASK))
+		{
+			archiveReport += ReportArchiveError(archiveName, "Archive Failed Its CRC Check. Results For Its Entries May Be Wrong.");
+		}
+	}
+	catch (const runtime_error& e) {
+		archiveReport += ReportArchiveError(archiveName, e.what());
+	}
+
+	return archiveReport;
+}
+//Action: validate a single log file entry read from an archive
+//Parameter: entryPath (string) archive name and path of the entry, entry stream
+//Return: report section for the entry
+string ValidateArchiveEntry(string entryPath, istream& entry)
+{
+	string entryReport = "\n\n\n\nNow Validating Log File '" + entryPath + "':\n\n";
+	try {
+		entryReport += ValidateStream(entry, DEFAULT_ROW_LIMITS);
+	}
+	catch (const runtime_error& e) {
+		entryReport += "Log Archive Error: " + string(e.what()) + " File Could Not Be Fully Read.\n";
+	}
+	entryReport += extraContent;
+	extraContent = "";
+
+	return entryReport;
+}
+//Action: read whatever the validator left of an archive entry, then compare the entry's CRC-32 with the one the archive recorded.
+// nothing is checked if reading the entry already failed, since that error is in the report
+//Parameter: entry stream, checksum of the bytes read from it, CRC-32 recorded in the archive
+//Return: error message or empty
+string CheckArchiveEntryCrc(istream& entry, const Crc32Checksum& checksum, unsigned int expectedCrc)
+{
+	if (entry.bad())
+	{
+		return "";
+	}
+
+	try {
+		entry.ignore(numeric_limits<streamsize>::max());
+	}
+	catch (const runtime_error& e) {
+		return "Log Archive Error: " + string(e.what()) + " File Could Not Be Fully Read.\n";
+	}
+
+	if (checksum.Value != expectedCrc)
+	{
+		return "Log Archive Error: Entry Failed Its CRC Check.\n";
+	}
+
+	return "";
+}
+//Action: build the report section for a problem with a whole archive
+//Parameter: archiveName (string), error (string) describing the problem
+//Return: report section for the archive
+string ReportArchiveError(string archiveName, string error)
+{
+	return "\n\n\n\nNow Validating Log Archive '" + archiveName + "':\n\nLog Archive Error: " + error + "\n";
+}
+//Action: convert little endian bytes from an archive header to a number
+//Parameter: pointer to the first byte, amount of bytes
+//Return: number
+unsigned long long ReadLittleEndian(const char* bytes, int byteCount)
+{
+	unsigned long long value = 0;
+	for (int i = byteCount - 1; i >= 0; i--)
+	{
+		value = (value << 8) | static_cast<unsigned char>(bytes[i]);
+	}
+	return value;
+}
 //FOR VISUAL STUDIO IDE ONLY:
 // Run program: Ctrl + F5 or Debug > Start Without Debugging menu
 // Debug program: F5 or Debug > Start Debugging menu